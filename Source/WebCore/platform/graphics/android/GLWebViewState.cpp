@@ -34,6 +34,7 @@
 #include "AndroidLog.h"
 #include "BaseLayerAndroid.h"
 #include "ClassTracker.h"
+#include "DrawQuadData.h"
 #include "GLUtils.h"
 #include "ImagesManager.h"
 #include "LayerAndroid.h"
@@ -45,6 +46,7 @@
 #include "SurfaceCollection.h"
 #include "SurfaceCollectionManager.h"
 #include <pthread.h>
+#include <string.h>
 #include <wtf/CurrentTime.h>
 
 // log warnings if scale goes outside this range
@@ -58,15 +60,32 @@
 
 #define COLLECTION_SWAPPED_COUNTER_MODULE 10
 
+// Padding applied around each invalidation united into the framework inval.
+#define FRAMEWORK_INVAL_INFLATION 8
+
 namespace WebCore {
 
 using namespace android::uirenderer;
 
+#ifdef DEBUG
+// Indexed by GLWebViewState::LayersRenderingMode.
+static const char* const kLayersRenderingModeName[] = {
+    "kAllTextures",
+    "kClippedTextures",
+    "kScrollableAndFixedLayers",
+    "kFixedLayers",
+    "kSingleSurfaceRendering"
+};
+#endif
+
 GLWebViewState::GLWebViewState()
-    : m_frameworkLayersInval(0, 0, 0, 0)
+    : m_frameInfoWidth(0)
+    , m_frameInfoWidthF(0)
+    , m_frameworkLayersInval(0, 0, 0, 0)
     , m_doFrameworkFullInval(false)
     , m_isScrolling(false)
     , m_isVisibleContentRectScrolling(false)
+    , m_showVisualIndicator(false)
     , m_goingDown(true)
     , m_goingLeft(false)
     , m_scale(1)
@@ -115,6 +134,7 @@ bool GLWebViewState::setBaseLayer(BaseLayerAndroid* layer, bool showVisualIndica
     m_measurePerfs = showVisualIndicator;
 #endif
 
+    m_showVisualIndicator = showVisualIndicator;
     TilesManager::instance()->setShowVisualIndicator(showVisualIndicator);
     return queueFull;
 }
@@ -124,11 +144,36 @@ void GLWebViewState::scrollLayer(int layerId, int x, int y)
     m_surfaceCollectionManager.updateScrollableLayer(layerId, x, y);
 }
 
+// Branchless equality for the per-frame (visibleContentRect, scale) check.
+// The rect is handed down bit-identical from the Java side when nothing
+// changed, so comparing bit patterns is sufficient, and OR-ing the XOR-ed
+// lanes compiles to straight-line integer code (a single vector compare with
+// NEON) instead of five float compares and branches. A bitwise mismatch on
+// float-equal values (-0.0f vs 0.0f) only costs us the recompute path below,
+// never a wrong early return.
+static inline bool rectsBitwiseEqual(const SkRect& a, const SkRect& b)
+{
+    const uint32_t* pa = reinterpret_cast<const uint32_t*>(&a.fLeft);
+    const uint32_t* pb = reinterpret_cast<const uint32_t*>(&b.fLeft);
+    uint32_t diff = (pa[0] ^ pb[0]) | (pa[1] ^ pb[1])
+                    | (pa[2] ^ pb[2]) | (pa[3] ^ pb[3]);
+    return !diff;
+}
+
+static inline bool viewStateUnchanged(const SkRect& a, const SkRect& b,
+                                      float scaleA, float scaleB)
+{
+    union FloatBits { float f; uint32_t u; } sa, sb;
+    sa.f = scaleA;
+    sb.f = scaleB;
+    return rectsBitwiseEqual(a, b) & (sa.u == sb.u);
+}
+
 void GLWebViewState::setVisibleContentRect(const SkRect& visibleContentRect, float scale)
 {
     // allocate max possible number of tiles visible with this visibleContentRect / expandedTileBounds
-    const float invTileContentWidth = scale / TilesManager::tileWidth();
-    const float invTileContentHeight = scale / TilesManager::tileHeight();
+    const float invTileContentWidth = scale * TilesManager::invTileWidth();
+    const float invTileContentHeight = scale * TilesManager::invTileHeight();
 
     int viewMaxTileX =
         static_cast<int>(ceilf((visibleContentRect.width()-1) * invTileContentWidth)) + 1;
@@ -138,11 +183,13 @@ void GLWebViewState::setVisibleContentRect(const SkRect& visibleContentRect, flo
     TilesManager* tilesManager = TilesManager::instance();
     int maxTextureCount = viewMaxTileX * viewMaxTileY * (tilesManager->highEndGfx() ? 4 : 2);
 
+    // The texture count must be re-raised even when nothing changed: a
+    // memory trim can lower it asynchronously via discardTextures(), and
+    // this is the only place that sets it back up. Only the state updates
+    // below are safe to skip on a no-op call.
     tilesManager->setCurrentTextureCount(maxTextureCount);
 
-    // TODO: investigate whether we can move this return earlier.
-    if ((m_visibleContentRect == visibleContentRect)
-        && (m_scale == scale)) {
+    if (viewStateUnchanged(m_visibleContentRect, visibleContentRect, m_scale, scale)) {
         // everything below will stay the same, early return.
         m_isVisibleContentRectScrolling = false;
         return;
@@ -152,9 +199,16 @@ void GLWebViewState::setVisibleContentRect(const SkRect& visibleContentRect, flo
     m_goingDown = m_visibleContentRect.fTop - visibleContentRect.fTop <= 0;
     m_goingLeft = m_visibleContentRect.fLeft - visibleContentRect.fLeft >= 0;
 
-    // detect visibleContentRect scrolling from short programmatic scrolls/jumps
-    m_isVisibleContentRectScrolling = m_visibleContentRect != visibleContentRect
-        && SkRect::Intersects(m_visibleContentRect, visibleContentRect);
+    // detect visibleContentRect scrolling from short programmatic scrolls/jumps.
+    // Both the inequality and the overlap test (same strict compares as
+    // SkRect::Intersects) are evaluated as flag arithmetic and ANDed, so
+    // there are no short-circuit branches on the result.
+    int rectChanged = !rectsBitwiseEqual(m_visibleContentRect, visibleContentRect);
+    int rectsOverlap = (m_visibleContentRect.fLeft < visibleContentRect.fRight)
+        & (visibleContentRect.fLeft < m_visibleContentRect.fRight)
+        & (m_visibleContentRect.fTop < visibleContentRect.fBottom)
+        & (visibleContentRect.fTop < m_visibleContentRect.fBottom);
+    m_isVisibleContentRectScrolling = rectChanged & rectsOverlap;
     m_visibleContentRect = visibleContentRect;
 
     ALOGV("New visibleContentRect %.2f - %.2f %.2f - %.2f (w: %2.f h: %.2f scale: %.2f )",
@@ -166,11 +220,17 @@ void GLWebViewState::setVisibleContentRect(const SkRect& visibleContentRect, flo
 #ifdef MEASURES_PERF
 void GLWebViewState::dumpMeasures()
 {
-    for (int i = 0; i < m_timeCounter; i++) {
-        ALOGD("%d delay: %d ms", m_totalTimeCounter + i,
-             static_cast<int>(m_delayTimes[i]*1000));
-        m_delayTimes[i] = 0;
-    }
+    // Convert all the measures in a tight pass first, so the compiler can
+    // vectorize the double -> int ms conversions without the log I/O
+    // interleaved in the loop.
+    int delaysMs[MAX_MEASURES_PERF];
+    for (int i = 0; i < m_timeCounter; i++)
+        delaysMs[i] = static_cast<int>(m_delayTimes[i] * 1000);
+
+    for (int i = 0; i < m_timeCounter; i++)
+        ALOGD("%d delay: %d ms", m_totalTimeCounter + i, delaysMs[i]);
+
+    memset(m_delayTimes, 0, m_timeCounter * sizeof(m_delayTimes[0]));
     m_totalTimeCounter += m_timeCounter;
     m_timeCounter = 0;
 }
@@ -181,8 +241,12 @@ void GLWebViewState::addDirtyArea(const IntRect& rect)
     if (rect.isEmpty())
         return;
 
-    IntRect inflatedRect = rect;
-    inflatedRect.inflate(8);
+    // Construct the inflated rect directly rather than copying the source
+    // rect only to inflate the copy.
+    IntRect inflatedRect(rect.x() - FRAMEWORK_INVAL_INFLATION,
+                         rect.y() - FRAMEWORK_INVAL_INFLATION,
+                         rect.width() + 2 * FRAMEWORK_INVAL_INFLATION,
+                         rect.height() + 2 * FRAMEWORK_INVAL_INFLATION);
     if (m_frameworkLayersInval.isEmpty())
         m_frameworkLayersInval = inflatedRect;
     else
@@ -212,17 +276,20 @@ double GLWebViewState::setupDrawing(const IntRect& invScreenRect,
 
     // Make sure GL resources are created on the UI thread.
     // They are created either for the first time, or after EGL context
-    // recreation caused by onTrimMemory in the framework.
+    // recreation caused by onTrimMemory in the framework. In steady state
+    // nothing is pending, so only one branch is paid per frame.
     ShaderProgram* shader = tilesManager->shader();
-    if (shader->needsInit()) {
-        ALOGD("Reinit shader");
-        shader->initGLResources();
-    }
-    TransferQueue* transferQueue = tilesManager->transferQueue();
-    if (transferQueue->needsInit()) {
-        ALOGD("Reinit transferQueue");
-        transferQueue->initGLResources(TilesManager::tileWidth(),
-                                       TilesManager::tileHeight());
+    unsigned int pendingInits = tilesManager->pendingGLInits();
+    if (UNLIKELY(pendingInits)) {
+        if (pendingInits & TilesManager::ShaderNeedsInit) {
+            ALOGD("Reinit shader");
+            shader->initGLResources();
+        }
+        if (pendingInits & TilesManager::TransferQueueNeedsInit) {
+            ALOGD("Reinit transferQueue");
+            tilesManager->transferQueue()->initGLResources(
+                TilesManager::tileWidth(), TilesManager::tileHeight());
+        }
     }
     shader->setupDrawing(invScreenRect, visibleContentRect, screenRect,
                          titleBarHeight, screenClip, scale);
@@ -234,16 +301,17 @@ double GLWebViewState::setupDrawing(const IntRect& invScreenRect,
     return currentTime;
 }
 
-bool GLWebViewState::setLayersRenderingMode(TexturesResult& nbTexturesNeeded)
+bool GLWebViewState::setLayersRenderingMode(TexturesResult& nbTexturesNeeded,
+                                            TilesManager* tilesManager)
 {
     bool invalBase = false;
 
     if (!nbTexturesNeeded.full)
-        TilesManager::instance()->setCurrentLayerTextureCount(0);
+        tilesManager->setCurrentLayerTextureCount(0);
     else
-        TilesManager::instance()->setCurrentLayerTextureCount((2 * nbTexturesNeeded.full) + 1);
+        tilesManager->setCurrentLayerTextureCount((2 * nbTexturesNeeded.full) + 1);
 
-    int maxTextures = TilesManager::instance()->currentLayerTextureCount();
+    int maxTextures = tilesManager->currentLayerTextureCount();
     LayersRenderingMode layersRenderingMode = m_layersRenderingMode;
 
     if (m_layersRenderingMode == kSingleSurfaceRendering) {
@@ -252,18 +320,16 @@ bool GLWebViewState::setLayersRenderingMode(TexturesResult& nbTexturesNeeded)
         maxTextures /= 2;
     }
 
-    m_layersRenderingMode = kSingleSurfaceRendering;
-    if (nbTexturesNeeded.fixed < maxTextures)
-        m_layersRenderingMode = kFixedLayers;
-    if (nbTexturesNeeded.scrollable < maxTextures)
-        m_layersRenderingMode = kScrollableAndFixedLayers;
-    if (nbTexturesNeeded.clipped < maxTextures)
-        m_layersRenderingMode = kClippedTextures;
-    if (nbTexturesNeeded.full < maxTextures)
-        m_layersRenderingMode = kAllTextures;
-
-    if (!maxTextures && !nbTexturesNeeded.full)
-        m_layersRenderingMode = kAllTextures;
+    // Same cascade as a chain of ifs, but written as selects so it compiles
+    // to conditional moves instead of four data-dependent branches -- the
+    // comparisons flip from frame to frame and predict poorly.
+    int mode = kSingleSurfaceRendering;
+    mode = (nbTexturesNeeded.fixed < maxTextures) ? kFixedLayers : mode;
+    mode = (nbTexturesNeeded.scrollable < maxTextures) ? kScrollableAndFixedLayers : mode;
+    mode = (nbTexturesNeeded.clipped < maxTextures) ? kClippedTextures : mode;
+    mode = (nbTexturesNeeded.full < maxTextures) ? kAllTextures : mode;
+    mode = (!maxTextures && !nbTexturesNeeded.full) ? kAllTextures : mode;
+    m_layersRenderingMode = static_cast<LayersRenderingMode>(mode);
 
     if (m_layersRenderingMode < layersRenderingMode
         && m_layersRenderingMode != kAllTextures)
@@ -275,12 +341,10 @@ bool GLWebViewState::setLayersRenderingMode(TexturesResult& nbTexturesNeeded)
 
 #ifdef DEBUG
     if (m_layersRenderingMode != layersRenderingMode) {
-        char* mode[] = { "kAllTextures", "kClippedTextures",
-            "kScrollableAndFixedLayers", "kFixedLayers", "kSingleSurfaceRendering" };
         ALOGD("Change from mode %s to %s -- We need textures: fixed: %d,"
               " scrollable: %d, clipped: %d, full: %d, max textures: %d",
-              static_cast<char*>(mode[layersRenderingMode]),
-              static_cast<char*>(mode[m_layersRenderingMode]),
+              kLayersRenderingModeName[layersRenderingMode],
+              kLayersRenderingModeName[m_layersRenderingMode],
               nbTexturesNeeded.fixed,
               nbTexturesNeeded.scrollable,
               nbTexturesNeeded.clipped,
@@ -291,8 +355,8 @@ bool GLWebViewState::setLayersRenderingMode(TexturesResult& nbTexturesNeeded)
     // For now, anything below kClippedTextures is equivalent
     // to kSingleSurfaceRendering
     // TODO: implement the other rendering modes
-    if (m_layersRenderingMode > kClippedTextures)
-        m_layersRenderingMode = kSingleSurfaceRendering;
+    m_layersRenderingMode = (m_layersRenderingMode > kClippedTextures)
+        ? kSingleSurfaceRendering : m_layersRenderingMode;
 
     // update the base surface if needed
     // TODO: inval base layergroup when going into single surface mode
@@ -312,9 +376,40 @@ int GLWebViewState::drawGL(IntRect& invScreenRect, SkRect& visibleContentRect,
                            IntRect& screenClip, float scale,
                            bool* collectionsSwappedPtr, bool* newCollectionHasAnimPtr,
                            bool shouldDraw)
+{
+    // Dispatch once on shouldDraw; within each instantiation it's a
+    // compile-time constant, so the profiler and frame-info branches fold
+    // away entirely in the prepare-only (kStatusInvoke re-draw) variant.
+    if (shouldDraw) {
+        // Whole-frame cull: when the WebView is entirely offscreen (e.g.
+        // during a tab-switch animation) we can still get asked to draw with
+        // an empty rect or clip; nothing can be drawn or swapped, so skip
+        // texture gathering, uploads and the collection draw altogether.
+        // Only valid on the draw path -- process-mode callbacks arrive with
+        // a zeroed clip and must still run so painting/swapping progresses
+        // and "still working" is reported back as kStatusDraw/kStatusInvoke.
+        if (UNLIKELY(invScreenRect.isEmpty() || screenClip.isEmpty())) {
+            *collectionsSwappedPtr = false;
+            *newCollectionHasAnimPtr = false;
+            return 0;
+        }
+        return drawGLImpl<true>(invScreenRect, visibleContentRect, invalRect,
+                                screenRect, titleBarHeight, screenClip, scale,
+                                collectionsSwappedPtr, newCollectionHasAnimPtr);
+    }
+    return drawGLImpl<false>(invScreenRect, visibleContentRect, invalRect,
+                             screenRect, titleBarHeight, screenClip, scale,
+                             collectionsSwappedPtr, newCollectionHasAnimPtr);
+}
+
+template <bool ShouldDraw>
+int GLWebViewState::drawGLImpl(IntRect& invScreenRect, SkRect& visibleContentRect,
+                               IntRect* invalRect, IntRect& screenRect, int titleBarHeight,
+                               IntRect& screenClip, float scale,
+                               bool* collectionsSwappedPtr, bool* newCollectionHasAnimPtr)
 {
     TilesManager* tilesManager = TilesManager::instance();
-    if (shouldDraw)
+    if (ShouldDraw)
         tilesManager->getProfiler()->nextFrame(visibleContentRect.fLeft,
                                                visibleContentRect.fTop,
                                                visibleContentRect.fRight,
@@ -333,11 +428,16 @@ int GLWebViewState::drawGL(IntRect& invScreenRect, SkRect& visibleContentRect,
           screenRect.x(), screenRect.y(), screenRect.width(), screenRect.height(),
           screenClip.x(), screenClip.y(), screenClip.width(), screenClip.height(), scale, titleBarHeight);
 
-    m_inUnclippedDraw = shouldDraw && (screenRect == screenClip);
+    m_inUnclippedDraw = ShouldDraw && (screenRect == screenClip);
 
     resetLayersDirtyArea();
 
-    if (scale < MIN_SCALE_WARNING || scale > MAX_SCALE_WARNING)
+    // Fused range check: the product is negative iff scale is outside
+    // [MIN_SCALE_WARNING, MAX_SCALE_WARNING]. Computed once and reused for
+    // both warnings below, since scale doesn't change in between.
+    bool scaleOutOfRange =
+        (scale - MIN_SCALE_WARNING) * (MAX_SCALE_WARNING - scale) < 0;
+    if (scaleOutOfRange)
         ALOGW("WARNING, scale seems corrupted before update: %e", scale);
 
     tilesManager->updateTilesIfContextVerified();
@@ -350,10 +450,11 @@ int GLWebViewState::drawGL(IntRect& invScreenRect, SkRect& visibleContentRect,
     // Return true if we still have some images to upload.
     // TODO: upload as many textures as possible within a certain time limit
     int returnFlags = 0;
-    if (ImagesManager::instance()->prepareTextures(this))
+    ImagesManager* imagesManager = ImagesManager::instance();
+    if (imagesManager->prepareTextures(this))
         returnFlags |= DrawGlInfo::kStatusDraw;
 
-    if (scale < MIN_SCALE_WARNING || scale > MAX_SCALE_WARNING) {
+    if (scaleOutOfRange) {
         ALOGW("WARNING, scale seems corrupted after update: %e", scale);
         scale = 1.0f; // WORKAROUND for corrupted scale: use 1.0
     }
@@ -372,9 +473,9 @@ int GLWebViewState::drawGL(IntRect& invScreenRect, SkRect& visibleContentRect,
                                                      singleSurfaceMode,
                                                      collectionsSwappedPtr,
                                                      newCollectionHasAnimPtr,
-                                                     &nbTexturesNeeded, shouldDraw);
+                                                     &nbTexturesNeeded, ShouldDraw);
 
-    int nbTexturesForImages = ImagesManager::instance()->nbTextures();
+    int nbTexturesForImages = imagesManager->nbTextures();
     ALOGV("*** We have %d textures for images, %d full, %d clipped, total %d / %d",
           nbTexturesForImages, nbTexturesNeeded.full, nbTexturesNeeded.clipped,
           nbTexturesNeeded.full + nbTexturesForImages,
@@ -382,8 +483,8 @@ int GLWebViewState::drawGL(IntRect& invScreenRect, SkRect& visibleContentRect,
     nbTexturesNeeded.full += nbTexturesForImages;
     nbTexturesNeeded.clipped += nbTexturesForImages;
 
-    if (setLayersRenderingMode(nbTexturesNeeded)) {
-        TilesManager::instance()->dirtyAllTiles();
+    if (setLayersRenderingMode(nbTexturesNeeded, tilesManager)) {
+        tilesManager->dirtyAllTiles();
         returnFlags |= DrawGlInfo::kStatusDraw | DrawGlInfo::kStatusInvoke;
     }
 
@@ -420,24 +521,25 @@ int GLWebViewState::drawGL(IntRect& invScreenRect, SkRect& visibleContentRect,
         }
     }
 
-    if (shouldDraw)
-        showFrameInfo(invScreenRect, *collectionsSwappedPtr);
+    if (ShouldDraw) {
+        bool drawOrDumpFrameInfo = m_showVisualIndicator;
+#ifdef MEASURES_PERF
+        drawOrDumpFrameInfo |= m_measurePerfs;
+#endif
+        if (UNLIKELY(drawOrDumpFrameInfo))
+            showFrameInfo(invScreenRect, *collectionsSwappedPtr, currentTime);
+    }
 
     return returnFlags;
 }
 
-void GLWebViewState::showFrameInfo(const IntRect& rect, bool collectionsSwapped)
+// Only called when the visual indicator (or perf measurement) is enabled;
+// drawGL checks the cached flag before calling. The frame time comes from
+// setupDrawing's sample rather than a second WTF::currentTime() call --
+// close enough in wall clock, and frame-to-frame deltas stay unskewed.
+void GLWebViewState::showFrameInfo(const IntRect& rect, bool collectionsSwapped,
+                                   double currentDrawTime)
 {
-    bool showVisualIndicator = TilesManager::instance()->getShowVisualIndicator();
-
-    bool drawOrDumpFrameInfo = showVisualIndicator;
-#ifdef MEASURES_PERF
-    drawOrDumpFrameInfo |= m_measurePerfs;
-#endif
-    if (!drawOrDumpFrameInfo)
-        return;
-
-    double currentDrawTime = WTF::currentTime();
     double delta = currentDrawTime - m_prevDrawTime;
     m_prevDrawTime = currentDrawTime;
 
@@ -449,13 +551,31 @@ void GLWebViewState::showFrameInfo(const IntRect& rect, bool collectionsSwapped)
     }
 #endif
 
-    IntRect frameInfoRect = rect;
-    frameInfoRect.setHeight(FPS_INDICATOR_HEIGHT);
-    double ratio = (1.0 / delta) / MAX_FPS_VALUE;
+    if (UNLIKELY(rect.width() != m_frameInfoWidth)) {
+        m_frameInfoWidth = rect.width();
+        m_frameInfoWidthF = static_cast<float>(m_frameInfoWidth);
+    }
+
+    ShaderProgram* shader = TilesManager::instance()->shader();
 
-    clearRectWithColor(frameInfoRect, 1, 1, 1, 1);
-    frameInfoRect.setWidth(frameInfoRect.width() * ratio);
-    clearRectWithColor(frameInfoRect, 1, 0, 0, 1);
+    // rect is the global inverted-screen rect, but the quad path works in
+    // webview-local inv-view coordinates (ShaderProgram::clip adds the view
+    // origin back when programming the scissor), so draw at the local
+    // origin. The collection draw also leaves the last layer's scissor in
+    // place; reset the clip to the full view first or the bars get clipped
+    // by whatever was drawn last.
+    shader->clip(FloatRect(0, 0, rect.width(), rect.height()));
+
+    // Both bars share the same white background; draw it as a single quad
+    // spanning the two rows, so the whole indicator is three quads through
+    // one shader/blend setup instead of four.
+    IntRect frameInfoRect(0, 0, rect.width(), 2 * FPS_INDICATOR_HEIGHT);
+    drawFrameInfoRect(shader, frameInfoRect, Color(255, 255, 255));
+
+    frameInfoRect.setHeight(FPS_INDICATOR_HEIGHT);
+    float ratio = 1.0f / (static_cast<float>(delta) * MAX_FPS_VALUE);
+    frameInfoRect.setWidth(static_cast<int>(m_frameInfoWidthF * ratio));
+    drawFrameInfoRect(shader, frameInfoRect, Color(255, 0, 0));
 
     // Draw the collection swap counter as a circling progress bar.
     // This will basically show how fast we are updating the collection.
@@ -463,23 +583,27 @@ void GLWebViewState::showFrameInfo(const IntRect& rect, bool collectionsSwapped)
     if (collectionsSwapped)
         swappedCounter = (swappedCounter + 1) % COLLECTION_SWAPPED_COUNTER_MODULE;
 
-    frameInfoRect = rect;
-    frameInfoRect.setHeight(FPS_INDICATOR_HEIGHT);
-    frameInfoRect.move(0, FPS_INDICATOR_HEIGHT);
-
-    clearRectWithColor(frameInfoRect, 1, 1, 1, 1);
-    ratio = (swappedCounter + 1.0) / COLLECTION_SWAPPED_COUNTER_MODULE;
+    frameInfoRect = IntRect(0, FPS_INDICATOR_HEIGHT,
+                            rect.width(), FPS_INDICATOR_HEIGHT);
+    ratio = (swappedCounter + 1.0f) * (1.0f / COLLECTION_SWAPPED_COUNTER_MODULE);
 
-    frameInfoRect.setWidth(frameInfoRect.width() * ratio);
-    clearRectWithColor(frameInfoRect, 0, 1, 0, 1);
+    frameInfoRect.setWidth(static_cast<int>(m_frameInfoWidthF * ratio));
+    drawFrameInfoRect(shader, frameInfoRect, Color(0, 255, 0));
 }
 
-void GLWebViewState::clearRectWithColor(const IntRect& rect, float r, float g,
-                                      float b, float a)
+// Draw an indicator rect (given in webview-local inv-view coordinates) as an
+// opaque pure color quad. Unlike the previous scissor + glClear approach, all
+// the bars go through one shader setup with no clear or scissor state changes
+// in between -- small clears force expensive state revalidation on tiled GPUs.
+void GLWebViewState::drawFrameInfoRect(ShaderProgram* shader, const IntRect& rect,
+                                       const Color& color)
 {
-    glScissor(rect.x(), rect.y(), rect.width(), rect.height());
-    glClearColor(r, g, b, a);
-    glClear(GL_COLOR_BUFFER_BIT);
+    FloatRect contentRect =
+        shader->convertInvViewCoordToContentCoord(FloatRect(rect));
+    SkRect geometry = SkRect::MakeXYWH(contentRect.x(), contentRect.y(),
+                                       contentRect.width(), contentRect.height());
+    PureColorQuadData quadData(color, BaseQuad, 0, &geometry, 1.0f, false);
+    shader->drawQuad(&quadData);
 }
 
 } // namespace WebCore
@@ -54,7 +54,9 @@ namespace WebCore {
 class BaseLayerAndroid;
 class LayerAndroid;
 class ScrollableLayerAndroid;
+class ShaderProgram;
 class TexturesResult;
+class TilesManager;
 
 /////////////////////////////////////////////////////////////////////////////////
 // GL Architecture
@@ -175,7 +177,7 @@ public:
     void setIsScrolling(bool isScrolling) { m_isScrolling = isScrolling; }
     bool isScrolling() { return m_isScrolling || m_isVisibleContentRectScrolling; }
 
-    bool setLayersRenderingMode(TexturesResult&);
+    bool setLayersRenderingMode(TexturesResult&, TilesManager* tilesManager);
 
     int drawGL(IntRect& rect, SkRect& visibleContentRect, IntRect* invalRect,
                IntRect& screenRect, int titleBarHeight,
@@ -213,14 +215,28 @@ public:
     void scrollLayer(int layerId, int x, int y);
 
 private:
+    // drawGL specialized on its shouldDraw argument; each instantiation
+    // constant-folds the profiler/frame-info work, so the prepare-only
+    // variant carries none of it.
+    template <bool ShouldDraw>
+    int drawGLImpl(IntRect& rect, SkRect& visibleContentRect, IntRect* invalRect,
+                   IntRect& screenRect, int titleBarHeight,
+                   IntRect& clip, float scale,
+                   bool* collectionsSwappedPtr, bool* newCollectionHasAnimPtr);
     void setVisibleContentRect(const SkRect& visibleContentRect, float scale);
     double setupDrawing(const IntRect& invScreenRect, const SkRect& visibleContentRect,
                         const IntRect& screenRect, int titleBarHeight,
                         const IntRect& screenClip, float scale);
-    void showFrameInfo(const IntRect& rect, bool collectionsSwapped);
-    void clearRectWithColor(const IntRect& rect, float r, float g,
-                            float b, float a);
+    void showFrameInfo(const IntRect& rect, bool collectionsSwapped,
+                       double currentDrawTime);
+    void drawFrameInfoRect(ShaderProgram* shader, const IntRect& rect,
+                           const Color& color);
     double m_prevDrawTime;
+    // The indicator rect width only changes on relayout; cache its float
+    // value so showFrameInfo's per-frame bar math stays in single precision
+    // without re-converting.
+    int m_frameInfoWidth;
+    float m_frameInfoWidthF;
 
     SkRect m_visibleContentRect;
     IntRect m_frameworkLayersInval;
@@ -237,6 +253,10 @@ private:
 
     bool m_isScrolling;
     bool m_isVisibleContentRectScrolling;
+    // Mirror of TilesManager's show-visual-indicator flag, cached here (it
+    // only changes in setBaseLayer) so drawGL can skip the showFrameInfo
+    // call -- and its WTF::currentTime() sample -- in the common case.
+    bool m_showVisualIndicator;
     bool m_goingDown;
     bool m_goingLeft;
 
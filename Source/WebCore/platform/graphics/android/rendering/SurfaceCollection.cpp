@@ -37,9 +37,52 @@
 #include "Surface.h"
 #include "ScrollableLayerAndroid.h"
 #include "TilesManager.h"
+#include <utils/threads.h>
 
 namespace WebCore {
 
+////////////////////////////////////////////////////////////////////////////////
+//                           COLLECTION POOLING                               //
+////////////////////////////////////////////////////////////////////////////////
+
+// At most a few collections are alive at once (drawing, painting, queued),
+// and they are allocated/freed on every layout change. Recycle the two most
+// recently freed allocations instead of hitting the heap each time; if both
+// slots are busy we simply fall back to the allocator.
+static const unsigned gCollectionPoolSize = 2;
+static char gCollectionPool[gCollectionPoolSize][sizeof(SurfaceCollection)]
+    __attribute__((aligned(8)));
+static bool gCollectionPoolBusy[gCollectionPoolSize];
+static android::Mutex gCollectionPoolLock;
+
+void* SurfaceCollection::operator new(size_t size)
+{
+    if (size == sizeof(SurfaceCollection)) {
+        android::Mutex::Autolock lock(gCollectionPoolLock);
+        for (unsigned i = 0; i < gCollectionPoolSize; i++) {
+            if (!gCollectionPoolBusy[i]) {
+                gCollectionPoolBusy[i] = true;
+                return gCollectionPool[i];
+            }
+        }
+    }
+    return ::operator new(size);
+}
+
+void SurfaceCollection::operator delete(void* ptr)
+{
+    {
+        android::Mutex::Autolock lock(gCollectionPoolLock);
+        for (unsigned i = 0; i < gCollectionPoolSize; i++) {
+            if (ptr == gCollectionPool[i]) {
+                gCollectionPoolBusy[i] = false;
+                return;
+            }
+        }
+    }
+    ::operator delete(ptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //                        TILED PAINTING / SURFACES                           //
 ////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +47,13 @@ public:
     SurfaceCollection(BaseLayerAndroid* compositedRoot);
     virtual ~SurfaceCollection();
 
+    // setBaseLayer() creates a collection on every layout change, so under
+    // heavy DOM mutation this is a malloc/free churn on the critical path.
+    // Back the allocation with a small fixed pool of recycled slots; the
+    // lifetime (SkRefCnt) is unchanged, only the storage is reused.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
     // Tiled painting methods (executed on Surfaces)
     void prepareGL(const SkRect& visibleContentRect, bool tryToFastBlit = false);
     bool drawGL(const SkRect& visibleContentRect);
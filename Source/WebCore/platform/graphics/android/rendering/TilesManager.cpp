@@ -441,6 +441,12 @@ TransferQueue* TilesManager::transferQueue()
     return m_queue;
 }
 
+unsigned int TilesManager::pendingGLInits()
+{
+    return (m_shader.needsInit() ? ShaderNeedsInit : 0)
+        | (transferQueue()->needsInit() ? TransferQueueNeedsInit : 0);
+}
+
 // When GL context changed or we get a low memory signal, we want to cleanup all
 // the GPU memory webview is using.
 // The recreation will be on the next incoming draw call at the drawGL of
@@ -481,8 +487,12 @@ void TilesManager::updateTilesIfContextVerified()
         // Inside this function, just do GPU blits from the transfer queue into
         // the Tiles' texture.
         transferQueue()->updateDirtyTiles();
-        // Clean up GL textures for video layer.
-        videoLayerManager()->deleteUnusedTextures();
+        // Clean up GL textures for video layer. Retired video textures are
+        // rare, and glDeleteTextures can stall the driver, so sweep every 16
+        // frames rather than on each draw; cleanupGLResources still deletes
+        // immediately on teardown.
+        if (!(m_drawGLCount & 15))
+            videoLayerManager()->deleteUnusedTextures();
     }
     m_eglContext = ctx;
     return;
@@ -498,6 +508,16 @@ int TilesManager::tileHeight()
     return TILE_HEIGHT;
 }
 
+float TilesManager::invTileWidth()
+{
+    return 1.0f / TILE_WIDTH;
+}
+
+float TilesManager::invTileHeight()
+{
+    return 1.0f / TILE_HEIGHT;
+}
+
 TilesManager* TilesManager::instance()
 {
     if (!gInstance) {
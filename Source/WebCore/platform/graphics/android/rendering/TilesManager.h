@@ -72,6 +72,15 @@ public:
     TransferQueue* transferQueue();
     VideoLayerManager* videoLayerManager() { return &m_videoLayerManager; }
 
+    // GL resources waiting for (re)initialization after EGL context
+    // creation/recreation, as a bitmask that is 0 in steady state -- lets
+    // the per-frame setup test both with a single predicted-not-taken branch.
+    enum PendingGLInit {
+        ShaderNeedsInit = 1 << 0,
+        TransferQueueNeedsInit = 1 << 1
+    };
+    unsigned int pendingGLInits();
+
     void updateTilesIfContextVerified();
     void cleanupGLResources();
 
@@ -96,6 +105,10 @@ public:
     void setCurrentLayerTextureCount(int newTextureCount);
     static int tileWidth();
     static int tileHeight();
+    // Reciprocals of the (fixed) tile dimensions, so per-frame callers can
+    // multiply instead of dividing.
+    static float invTileWidth();
+    static float invTileHeight();
 
     void allocateTextures();
 